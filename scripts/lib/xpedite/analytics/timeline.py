@@ -496,9 +496,11 @@ def buildTimelineStats(category, route, probes, txnSubCollection): # pylint: dis
           if pmcCount != 0:
             timePoint.pmcNames = pmcNames
             timePoint.deltaPmcs = []
+            # pmc of multiplexed events are comparable, only if sampled by the same thread and group of events
+            isComparable = counter.threadId == prevCounter.threadId and counter.pmcGroup == prevCounter.pmcGroup
             for k in range(pmcCount):
-              deltaPmc = counter.pmcs[k] - prevCounter.pmcs[k] if counter.threadId == prevCounter.threadId  else NAN
-              endpoint.deltaPmcs[k] += (deltaPmc if counter.threadId == prevCounter.threadId else 0)
+              deltaPmc = counter.pmcs[k] - prevCounter.pmcs[k] if isComparable else NAN
+              endpoint.deltaPmcs[k] += (deltaPmc if isComparable else 0)
               timePoint.deltaPmcs.append(deltaPmc)
               deltaSeriesRepo[pmcNames[k]][i-1].addDelta(deltaPmc)
             if topdownMetrics:
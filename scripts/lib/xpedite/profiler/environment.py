@@ -278,6 +278,25 @@ class Environment(object):
     """Sends request to estimate frequency of cpu time stamp counter"""
     return self.admin('TscHz', timeout)
 
+  def getHistograms(self, reset=False, timeout=10):
+    """
+    Sends request to snapshot latency histograms, built by the collector of the active profile
+
+    :param reset: Clears histograms after the snapshot, to report latencies of each polling interval
+    :param timeout: Maximum time to await a response from app (Default value = 10 seconds)
+
+    """
+    return self.admin('GetHistograms --reset {}'.format(1 if reset else 0), timeout)
+
+  def trigger(self, timeout=10):
+    """
+    Sends request to dump samples, retained by the flight recorder of the active profile
+
+    :param timeout: Maximum time to await a response from app (Default value = 10 seconds)
+
+    """
+    return self.admin('Trigger', timeout)
+
   def __enter__(self):
     """Instantiates a tcp client and connects to the target application"""
     if self.client:
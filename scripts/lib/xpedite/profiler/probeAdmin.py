@@ -37,23 +37,32 @@ class ProbeAdmin(object):
     else:
       raise Exception('failed to query probes - have you instrumentd any xpedite probes in your binary ?')
 
+  # max size of a request, batching keys of probes - must fit in a frame of the target's framer (8 KB)
+  MAX_REQUEST_SIZE = 4096
+
   @staticmethod
-  def _updateProbe(app, anchoredProbe, targetState):
+  def _updateProbes(app, anchoredProbes, targetState):
     """
-    Updates state of the given probe in the target process
+    Updates state of the given probes in the target process, batching probes in as few requests as possible
 
     :param app: Handle to an instance of the xpedite app
     :type app: xpedite.profiler.app.XpediteApp
-    :param anchoredProbe: The probe to activate/deactive
-    :type anchoredProbe: xpedite.types.probe.AnchoredProbe
-    :param targetState: Activation/deactivaatione flag for the given probe
+    :param anchoredProbes: The probes to activate/deactive
+    :param targetState: Activation/deactivaatione flag for the given probes
     :type targetState: bool
 
     """
-    probeFilePath = os.path.basename(anchoredProbe.filePath)
     cmd = 'ActivateProbe' if targetState else 'DeactivateProbe'
-    cmd += ' --file {} --line {}'.format(probeFilePath, anchoredProbe.lineNo)
-    return app.admin(cmd, timeout=10)
+    request = cmd
+    for anchoredProbe in anchoredProbes:
+      probeFilePath = os.path.basename(anchoredProbe.filePath)
+      key = ' --file {} --line {}'.format(probeFilePath, anchoredProbe.lineNo)
+      if request != cmd and len(request) + len(key) > ProbeAdmin.MAX_REQUEST_SIZE:
+        app.admin(request, timeout=10)
+        request = cmd
+      request += key
+    if request != cmd:
+      app.admin(request, timeout=10)
 
   @staticmethod
   def updateProbes(app, anchoredProbes, targetState):
@@ -68,8 +77,7 @@ class ProbeAdmin(object):
 
     """
 
-    for probe in anchoredProbes:
-      ProbeAdmin._updateProbe(app, probe, targetState)
+    ProbeAdmin._updateProbes(app, anchoredProbes, targetState)
 
     errCount = 0
     errMsg = ''
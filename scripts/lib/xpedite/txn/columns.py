@@ -0,0 +1,98 @@
+"""
+Columnar samples
+
+This module loads samples, exported by xpediteSamplesLoader in columnar format
+(xpediteSamplesLoader -f columns), as numpy arrays.
+Each block of the export is accessed through numpy views, without any parsing.
+
+The layout of the export is documented in include/xpedite/framework/SamplesColumns.H
+
+Author: Manikandan Dhamodharan, Morgan Stanley
+"""
+
+import struct
+import numpy
+
+COLUMNS_SIGNATURE = 0x58504453414D434F
+COLUMNS_VERSION = 0x0101
+
+HEADER = struct.Struct('<QIIQIIII')
+CALL_SITE = struct.Struct('<QII')
+THREAD = struct.Struct('<QQ')
+BLOCK = struct.Struct('<II')
+
+FLAG_DATA = 1 << 0
+FLAG_PMC = 1 << 1
+FLAG_PAYLOAD = 1 << 2
+FLAG_PMC_SCALED = 1 << 3
+PMC_GROUP_SHIFT = 8
+UNKNOWN_CALL_SITE = 0xFFFFFFFF
+
+class SamplesColumns(object):
+  """Columns of samples, captured by one or more threads (merged in tsc order)"""
+
+  def __init__(self, buffer):
+    """
+    Builds numpy views for samples in the given buffer
+
+    :param buffer: Buffer with samples in columnar format (bytes or mmap)
+
+    """
+    signature, version, self.pmcCount, self.tscHz, callSiteCount, _, threadCount, _ = HEADER.unpack_from(buffer, 0)
+    if signature != COLUMNS_SIGNATURE or version != COLUMNS_VERSION:
+      raise Exception('detected invalid samples export - mismatch in signature/version')
+    offset = HEADER.size
+    self.callSites = {}
+    for _ in range(callSiteCount):
+      returnSite, callSiteId, _ = CALL_SITE.unpack_from(buffer, offset)
+      self.callSites[callSiteId] = returnSite
+      offset += CALL_SITE.size
+    self.threads = []
+    for _ in range(threadCount):
+      self.threads.append(THREAD.unpack_from(buffer, offset))
+      offset += THREAD.size
+
+    blocks = []
+    while True:
+      count, _ = BLOCK.unpack_from(buffer, offset)
+      offset += BLOCK.size
+      if count == 0:
+        break
+      block, offset = self.loadBlock(buffer, offset, count)
+      blocks.append(block)
+
+    def concat(index):
+      """Concatenates a column across all blocks"""
+      return numpy.concatenate([block[index] for block in blocks]) if blocks else numpy.empty(0)
+    self.tsc, self.callSiteId, self.flags, self.thread, self.dataHi, self.dataLo = (concat(i) for i in range(6))
+    self.pmc = [concat(6 + k) for k in range(self.pmcCount)]
+
+  def loadBlock(self, buffer, offset, count):
+    """Returns views of columns in a block and offset of the next block"""
+    columns = []
+    for dtype in (numpy.uint64, numpy.uint32, numpy.uint32, numpy.uint32, numpy.uint64, numpy.uint64):
+      columns.append(numpy.frombuffer(buffer, dtype=dtype, count=count, offset=offset))
+      size = count * numpy.dtype(dtype).itemsize
+      offset += (size + 7) // 8 * 8
+    for _ in range(self.pmcCount):
+      columns.append(numpy.frombuffer(buffer, dtype=numpy.uint64, count=count, offset=offset))
+      offset += count * 8
+    return columns, offset
+
+  @property
+  def pmcGroup(self):
+    """Returns the group of multiplexed pmc events, counted by each sample (deltas are valid only within a group)"""
+    return (self.flags >> PMC_GROUP_SHIFT) & 0xFF
+
+  def __len__(self):
+    return len(self.tsc)
+
+def loadColumns(path):
+  """
+  Loads samples from a columnar export file
+
+  :param path: Path of the file, written by xpediteSamplesLoader -f columns -o <path>
+
+  """
+  with open(path, 'rb') as fileHandle:
+    return SamplesColumns(fileHandle.read())
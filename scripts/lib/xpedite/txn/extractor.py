@@ -6,6 +6,7 @@ A decoder is used to open and extract timing and pmc data captured by
 probes in the target application.
 Each such decoded record is inturn used to construct a Counter object for
 transaction building.
+Chunks of rotated samples files are loaded together, for each thread.
 
 Author: Manikandan Dhamodharan, Morgan Stanley
 """
@@ -34,7 +35,7 @@ class Extractor(object):
     :type counterFilter: xpedite.filter.TrivialCounterFilter
 
     """
-    self.binaryReportFilePattern = re.compile(r'[^\d]*(\d+)-(\d+)-([0-9a-fA-F]+)\.data')
+    self.binaryReportFilePattern = re.compile(r'[^\d]*(\d+)-(\d+)-([0-9a-fA-F]+)(?:\.(\d+))?\.data')
     self.counterFilter = counterFilter
     self.orphanedRecords = []
 
@@ -55,16 +56,14 @@ class Extractor(object):
     dataSource = DataSource(app.appInfoPath, samplePath)
     loader.beginCollection(dataSource)
 
-    for filePath in filePaths:
-      (threadId, tlsAddr) = self.extractThreadInfo(filePath)
-      if not threadId or not tlsAddr:
-        raise Exception('failed to extract thread info for file {}'.format(filePath))
+    for (threadId, tlsAddr), chunkPaths in self.groupChunks(filePaths):
+      filePath = ' '.join(chunkPaths)
       LOGGER.info('loading counters for thread %s from file %s -> ', threadId, filePath)
 
       iterBegin = begin = time.time()
       loader.beginLoad(threadId, tlsAddr)
       inflateFd = self.openInflateFile(samplePath, threadId, tlsAddr)
-      extractor = subprocess.Popen([self.samplesLoader, filePath],
+      extractor = subprocess.Popen([self.samplesLoader] + chunkPaths,
         bufsize=2*1024*1024, stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
       recordCount = 0
       while True:
@@ -102,7 +101,8 @@ class Extractor(object):
   INDEX_TSC = 0
   INDEX_ADDR = 1
   INDEX_DATA = 2
-  INDEX_PMC = 3
+  INDEX_PMC_GROUP = 3
+  INDEX_PMC = 4
 
   def loadCounter(self, threadId, loader, probes, record):
     """
@@ -125,8 +125,9 @@ class Extractor(object):
     tsc = long(fields[self.INDEX_TSC], 16)
 
     counter = Counter(threadId, probes[addr], data, tsc)
-    if len(fields) > self.MIN_FIELD_COUNT:
-      for pmc in fields[self.MIN_FIELD_COUNT+1:]:
+    if len(fields) > self.INDEX_PMC_GROUP:
+      counter.pmcGroup = int(fields[self.INDEX_PMC_GROUP])
+      for pmc in fields[self.INDEX_PMC:]:
         counter.addPmc(long(pmc))
     if self.counterFilter.canLoad(counter):
       loader.loadCounter(counter)
@@ -147,6 +148,23 @@ class Extractor(object):
     filePath = os.path.join(path, 'samples-0000.csv')
     return open(filePath, 'w')
 
+  def groupChunks(self, filePaths):
+    """
+    Groups samples files by thread, with chunks of rotated files ordered by chunk number
+
+    :param filePaths: Paths of samples files for the current profile session
+
+    """
+    threads = {}
+    for filePath in filePaths:
+      (threadId, tlsAddr) = self.extractThreadInfo(filePath)
+      if not threadId or not tlsAddr:
+        raise Exception('failed to extract thread info for file {}'.format(filePath))
+      match = self.binaryReportFilePattern.findall(filePath)
+      chunk = int(match[0][3]) if match[0][3] else -1
+      threads.setdefault((threadId, tlsAddr), []).append((chunk, filePath))
+    return [(key, [path for _, path in sorted(chunks)]) for key, chunks in threads.items()]
+
   def extractThreadInfo(self, samplesFile):
     """
     Extracts thread id/thread local storage address from name of the samples file
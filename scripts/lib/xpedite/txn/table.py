@@ -0,0 +1,86 @@
+"""
+Transaction table
+
+This module memory maps transaction tables, built by xpediteTxnBuilder.
+A txn table is a flat binary file with fixed size records, that can be
+accessed in place without parsing.
+
+The layout of the table is documented in include/xpedite/txn/TxnTable.H
+
+Author: Manikandan Dhamodharan, Morgan Stanley
+"""
+
+import mmap
+import struct
+
+TXN_TABLE_SIGNATURE = 0x58504454584E5442
+TXN_TABLE_VERSION = 0x0102
+TXN_FLAG_MIXED_PMC_GROUPS = 1 << 0
+
+HEADER = struct.Struct('<QIIQIIQQQQQQQ')
+PROBE = struct.Struct('<QII')
+THREAD = struct.Struct('<QQ')
+TXN = struct.Struct('<QQIIII')
+COUNTER = struct.Struct('<QIIQQII')
+PMC = struct.Struct('<Q')
+
+class TxnTable(object):
+  """Memory mapped view of transactions, rebuilt from probe samples"""
+
+  def __init__(self, path):
+    """
+    Maps the txn table at the given path
+
+    :param path: Path of the txn table file
+
+    """
+    with open(path, 'rb') as fileHandle:
+      self.buffer = mmap.mmap(fileHandle.fileno(), 0, access=mmap.ACCESS_READ)
+    (signature, version, self.pmcCount, self.tscHz, self.probeCount, self.threadCount, self.txnCount,
+      self.counterCount, self.compromisedCount, self.extraneousCount, self.sampledTxnCount,
+      self.skippedTxnCount, self.mixedPmcCount) = HEADER.unpack_from(self.buffer, 0)
+    if signature != TXN_TABLE_SIGNATURE or version != TXN_TABLE_VERSION:
+      self.buffer.close()
+      raise Exception('detected invalid txn table {} - mismatch in signature/version'.format(path))
+    self.probeOffset = HEADER.size
+    self.threadOffset = self.probeOffset + self.probeCount * PROBE.size
+    self.txnOffset = self.threadOffset + self.threadCount * THREAD.size
+    self.counterOffset = self.txnOffset + self.txnCount * TXN.size
+    self.pmcOffset = self.counterOffset + self.counterCount * COUNTER.size
+
+  def scaleFactor(self):
+    """Returns the factor to scale counts of transactions by, to account for txns skipped under txn sampling"""
+    if not self.sampledTxnCount:
+      return 1.0
+    return float(self.sampledTxnCount + self.skippedTxnCount) / self.sampledTxnCount
+
+  def probe(self, index):
+    """Returns (return site, id, attributes) of the probe at the given index"""
+    return PROBE.unpack_from(self.buffer, self.probeOffset + index * PROBE.size)
+
+  def thread(self, index):
+    """Returns (thread id, tls address) of the thread at the given index"""
+    return THREAD.unpack_from(self.buffer, self.threadOffset + index * THREAD.size)
+
+  def txn(self, index):
+    """Returns (txn id, index of first counter, counter count, fragment count, flags) of the txn at the given index"""
+    return TXN.unpack_from(self.buffer, self.txnOffset + index * TXN.size)[:5]
+
+  def counter(self, index):
+    """Returns (tsc, probe index, thread index, data low, data high, pmc group, pmc values) of the counter at the given index"""
+    tsc, probe, thread, dataLow, dataHigh, pmcGroup, _ = COUNTER.unpack_from(
+      self.buffer, self.counterOffset + index * COUNTER.size
+    )
+    pmcBegin = self.pmcOffset + index * self.pmcCount * PMC.size
+    pmc = struct.unpack_from('<{}Q'.format(self.pmcCount), self.buffer, pmcBegin) if self.pmcCount else ()
+    return (tsc, probe, thread, dataLow, dataHigh, pmcGroup, pmc)
+
+  def txns(self):
+    """Generates (txn id, list of counters) for all transactions in the table"""
+    for i in range(self.txnCount):
+      txnId, begin, size, _, _ = self.txn(i)
+      yield txnId, [self.counter(begin + j) for j in range(size)]
+
+  def close(self):
+    """Unmaps the txn table"""
+    self.buffer.close()
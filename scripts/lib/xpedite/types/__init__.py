@@ -25,6 +25,7 @@ class Counter(object):
     self.txnId = None
     self.data = data
     self.tsc = tsc
+    self.pmcGroup = 0
     self.pmcs = []
 
   def addPmc(self, pmc):